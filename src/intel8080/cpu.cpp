@@ -18,13 +18,30 @@ inline static std::tuple<uint16_t, uint8_t> Subtraction(uint8_t lhs, uint8_t rhs
     return Addition(lhs, ~rhs, !carry);
 }
 
-CPU::CPU() {}
+CPU::CPU(ExecutionCore execution_core) : execution_core_(execution_core) {}
 
 CPU::~CPU() {}
 
 void CPU::Run()
 {
     executing_ = true;
+    switch (execution_core_)
+    {
+    case ExecutionCore::Threaded:
+    {
+        RunThreaded();
+    }
+    break;
+    case ExecutionCore::Table:
+    {
+        RunTable();
+    }
+    break;
+    }
+}
+
+void CPU::RunTable()
+{
     while (executing_)
     {
         uint8_t op_code = FetchInstruction();
@@ -64,644 +81,1108 @@ inline uint8_t CPU::FetchInstruction()
 
 void CPU::ExecuteInstruction(uint8_t op_code)
 {
-    if (op_code == InstructionSet::MOV_r1_r2)
-    {
-        if (op_code == InstructionSet::HLT)
-        {
-            throw std::runtime_error("HLT");
-        }
-        if (op_code == InstructionSet::MOV_r_M)
-        {
-            auto &destination = GetDestinationRegister(op_code);
-            destination = ReadMemory(hl_);
-
-            Logger::Instance() << "MOV_r_M\n";
-        }
-        else if (op_code == InstructionSet::MOV_M_r)
-        {
-            auto &source = GetSourceRegister(op_code);
-            WriteMemory(hl_, source);
-
-            Logger::Instance() << "MOV_M_r\n";
-        }
-        else // MOV_r1_r2
-        {
-            auto &destination = GetDestinationRegister(op_code);
-            auto &source = GetSourceRegister(op_code);
+    (this->*kInstructionTable[op_code])();
+}
 
-            destination = source;
+template <uint8_t op_code>
+consteval CPU::InstructionHandler CPU::DecodeInstruction() noexcept
+{
+    // The masks overlap, so the specific encodings (e.g. HLT inside MOV_r1_r2, the *_M forms inside the *_r forms) have to be tested first.
+    constexpr auto destination = GetDestinationRegisterCode(op_code);
+    constexpr auto source = GetSourceRegisterCode(op_code);
+    constexpr auto register_pair = GetRegisterPairCode(op_code);
+    constexpr auto condition = GetConditionCode(op_code);
+    constexpr auto interrupt = GetInterruptNumber(op_code);
 
-            Logger::Instance() << "MOV_r1_r2\n";
-        }
+    if constexpr (op_code == InstructionSet::HLT)
+    {
+        return &CPU::HLT;
     }
-    else if (op_code == InstructionSet::MVI_r)
+    else if constexpr (op_code == InstructionSet::MOV_r_M)
     {
-        if (op_code == InstructionSet::MVI_M)
-        {
-            uint8_t immediate = ReadImmediate();
-            WriteMemory(hl_, immediate);
-
-            Logger::Instance() << "MVI_M\n";
-        }
-        else // MVI_r
-        {
-            auto &destination = GetDestinationRegister(op_code);
-            destination = ReadImmediate();
-
-            Logger::Instance() << "MIV_r\n";
-        }
+        return &CPU::MOV_r_M<destination>;
     }
-    else if (op_code == InstructionSet::LXI)
+    else if constexpr (op_code == InstructionSet::MOV_M_r)
     {
-        auto &destination = GetRegisterPair(op_code);
-        destination = ReadImmediateDWord();
-
-        Logger::Instance() << "LXI\n";
+        return &CPU::MOV_M_r<source>;
     }
-    else if (op_code == InstructionSet::LDAX)
+    else if constexpr (op_code == InstructionSet::MOV_r1_r2)
     {
-        if (op_code == InstructionSet::LDA)
-        {
-            uint16_t immediate = ReadImmediateDWord();
-            a_ = ReadMemory(immediate);
-        }
-        else if (op_code == InstructionSet::LHLD)
-        {
-            uint16_t immediate = ReadImmediateDWord();
-            l_ = ReadMemory(immediate);
-            h_ = ReadMemory(++immediate);
-
-            Logger::Instance() << "LHLD: " << l_ << " <- (" << immediate - 1 << ") && " << h_ << " <- (" << immediate << ")\n";
-        }
-        else // LDAX
-        {
-            auto &source = GetRegisterPair(op_code);
-
-            a_ = ReadMemory(source);
-
-            Logger::Instance() << "LDAX: " << a_ << " <- (" << source << ")\n";
-        }
+        return &CPU::MOV_r1_r2<destination, source>;
     }
-    else if (op_code == InstructionSet::STAX)
+    else if constexpr (op_code == InstructionSet::MVI_M)
     {
-        if (op_code == InstructionSet::STA)
-        {
-            uint16_t immediate = ReadImmediateDWord();
-            WriteMemory(immediate, a_);
-
-            Logger::Instance() << "STA: (" << int(immediate) << ")" << a_ << "\n";
-        }
-        else if (op_code == InstructionSet::SHLD)
-        {
-            uint16_t immediate = ReadImmediateDWord();
-            WriteMemory(immediate, l_);
-            WriteMemory(++immediate, h_);
-
-            Logger::Instance() << "SHLD: (" << immediate - 1 << ") <- " << l_ << " && (" << immediate << ")" << h_ << "\n";
-        }
-        else // STAX
-        {
-            auto &destination = GetRegisterPair(op_code);
-            WriteMemory(destination, a_);
-
-            Logger::Instance() << "STAX: (" << destination << ") <- " << a_ << "\n";
-        }
+        return &CPU::MVI_M;
     }
-    else if (op_code == InstructionSet::XCHG)
+    else if constexpr (op_code == InstructionSet::MVI_r)
     {
-        swap(h_, d_);
-        swap(l_, e_);
-
-        Logger::Instance() << "XCHG\n";
+        return &CPU::MVI_r<destination>;
     }
-    else if (op_code == InstructionSet::ADD_r)
+    else if constexpr (op_code == InstructionSet::LXI)
     {
-        if (op_code == InstructionSet::ADD_M)
-        {
-            uint8_t memory = ReadMemory(hl_);
-            ADD(memory);
-        }
-        else // ADD_r
-        {
-            auto &source = GetSourceRegister(op_code);
-            ADD(source);
-        }
+        return &CPU::LXI<register_pair>;
     }
-    else if (op_code == InstructionSet::ADI)
+    else if constexpr (op_code == InstructionSet::LDA)
     {
-        uint8_t immediate = ReadImmediate();
-        ADD(immediate);
+        return &CPU::LDA;
     }
-    else if (op_code == InstructionSet::ADC_r)
+    else if constexpr (op_code == InstructionSet::LHLD)
     {
-        if (op_code == InstructionSet::ADC_M)
-        {
-            uint8_t memory = ReadMemory(hl_);
-            ADC(memory);
-        }
-        else // ADC_r
-        {
-            auto &source = GetSourceRegister(op_code);
-            ADC(source);
-        }
+        return &CPU::LHLD;
     }
-    else if (op_code == InstructionSet::ACI)
+    else if constexpr (op_code == InstructionSet::LDAX)
     {
-        uint8_t immediate = ReadImmediate();
-        ADC(immediate);
+        return &CPU::LDAX<register_pair>;
     }
-    else if (op_code == InstructionSet::SUB_r)
+    else if constexpr (op_code == InstructionSet::STA)
     {
-        if (op_code == InstructionSet::SUB_M)
-        {
-            uint8_t memory = ReadMemory(hl_);
-            SUB(memory);
-        }
-        else // SUB_r
-        {
-            auto &source = GetSourceRegister(op_code);
-            SUB(source);
-        }
+        return &CPU::STA;
     }
-    else if (op_code == InstructionSet::SUI)
+    else if constexpr (op_code == InstructionSet::SHLD)
     {
-        uint8_t immediate = ReadImmediate();
-        SUB(immediate);
+        return &CPU::SHLD;
     }
-    else if (op_code == InstructionSet::SBB_r)
+    else if constexpr (op_code == InstructionSet::STAX)
     {
-        if (op_code == InstructionSet::SBB_M)
-        {
-            uint8_t memory = ReadMemory(hl_);
-            SBB(memory);
-        }
-        else // SBB_r
-        {
-            auto &source = GetSourceRegister(op_code);
-            SBB(source);
-        }
+        return &CPU::STAX<register_pair>;
     }
-    else if (op_code == InstructionSet::SBI)
+    else if constexpr (op_code == InstructionSet::XCHG)
     {
-        uint8_t immediate = ReadImmediate();
-        SBB(immediate);
+        return &CPU::XCHG;
     }
-    else if (op_code == InstructionSet::INR_r)
+    else if constexpr (op_code == InstructionSet::ADD_M)
     {
-        if (op_code == InstructionSet::INR_M)
-        {
-            uint8_t memory = ReadMemory(hl_);
-            uint8_t result = INR(memory);
-            WriteMemory(hl_, result);
+        return &CPU::ADD_M;
+    }
+    else if constexpr (op_code == InstructionSet::ADD_r)
+    {
+        return &CPU::ADD_r<source>;
+    }
+    else if constexpr (op_code == InstructionSet::ADI)
+    {
+        return &CPU::ADI;
+    }
+    else if constexpr (op_code == InstructionSet::ADC_M)
+    {
+        return &CPU::ADC_M;
+    }
+    else if constexpr (op_code == InstructionSet::ADC_r)
+    {
+        return &CPU::ADC_r<source>;
+    }
+    else if constexpr (op_code == InstructionSet::ACI)
+    {
+        return &CPU::ACI;
+    }
+    else if constexpr (op_code == InstructionSet::SUB_M)
+    {
+        return &CPU::SUB_M;
+    }
+    else if constexpr (op_code == InstructionSet::SUB_r)
+    {
+        return &CPU::SUB_r<source>;
+    }
+    else if constexpr (op_code == InstructionSet::SUI)
+    {
+        return &CPU::SUI;
+    }
+    else if constexpr (op_code == InstructionSet::SBB_M)
+    {
+        return &CPU::SBB_M;
+    }
+    else if constexpr (op_code == InstructionSet::SBB_r)
+    {
+        return &CPU::SBB_r<source>;
+    }
+    else if constexpr (op_code == InstructionSet::SBI)
+    {
+        return &CPU::SBI;
+    }
+    else if constexpr (op_code == InstructionSet::INR_M)
+    {
+        return &CPU::INR_M;
+    }
+    else if constexpr (op_code == InstructionSet::INR_r)
+    {
+        return &CPU::INR_r<destination>;
+    }
+    else if constexpr (op_code == InstructionSet::DCR_M)
+    {
+        return &CPU::DCR_M;
+    }
+    else if constexpr (op_code == InstructionSet::DCR_r)
+    {
+        return &CPU::DCR_r<destination>;
+    }
+    else if constexpr (op_code == InstructionSet::INX)
+    {
+        return &CPU::INX<register_pair>;
+    }
+    else if constexpr (op_code == InstructionSet::DCX)
+    {
+        return &CPU::DCX<register_pair>;
+    }
+    else if constexpr (op_code == InstructionSet::DAD)
+    {
+        return &CPU::DAD<register_pair>;
+    }
+    else if constexpr (op_code == InstructionSet::DAA)
+    {
+        return &CPU::DAA;
+    }
+    else if constexpr (op_code == InstructionSet::ANA_M)
+    {
+        return &CPU::ANA_M;
+    }
+    else if constexpr (op_code == InstructionSet::ANA_r)
+    {
+        return &CPU::ANA_r<source>;
+    }
+    else if constexpr (op_code == InstructionSet::ANI)
+    {
+        return &CPU::ANI;
+    }
+    else if constexpr (op_code == InstructionSet::XRA_M)
+    {
+        return &CPU::XRA_M;
+    }
+    else if constexpr (op_code == InstructionSet::XRA_r)
+    {
+        return &CPU::XRA_r<source>;
+    }
+    else if constexpr (op_code == InstructionSet::XRI)
+    {
+        return &CPU::XRI;
+    }
+    else if constexpr (op_code == InstructionSet::ORA_M)
+    {
+        return &CPU::ORA_M;
+    }
+    else if constexpr (op_code == InstructionSet::ORA_r)
+    {
+        return &CPU::ORA_r<source>;
+    }
+    else if constexpr (op_code == InstructionSet::ORI)
+    {
+        return &CPU::ORI;
+    }
+    else if constexpr (op_code == InstructionSet::CMP_M)
+    {
+        return &CPU::CMP_M;
+    }
+    else if constexpr (op_code == InstructionSet::CMP_r)
+    {
+        return &CPU::CMP_r<source>;
+    }
+    else if constexpr (op_code == InstructionSet::CPI)
+    {
+        return &CPU::CPI;
+    }
+    else if constexpr (op_code == InstructionSet::RLC)
+    {
+        return &CPU::RLC;
+    }
+    else if constexpr (op_code == InstructionSet::RRC)
+    {
+        return &CPU::RRC;
+    }
+    else if constexpr (op_code == InstructionSet::RAL)
+    {
+        return &CPU::RAL;
+    }
+    else if constexpr (op_code == InstructionSet::RAR)
+    {
+        return &CPU::RAR;
+    }
+    else if constexpr (op_code == InstructionSet::CMA)
+    {
+        return &CPU::CMA;
+    }
+    else if constexpr (op_code == InstructionSet::CMC)
+    {
+        return &CPU::CMC;
+    }
+    else if constexpr (op_code == InstructionSet::STC)
+    {
+        return &CPU::STC;
+    }
+    else if constexpr (op_code == InstructionSet::JMP)
+    {
+        return &CPU::JMP;
+    }
+    else if constexpr (op_code == InstructionSet::JC)
+    {
+        return &CPU::JC<condition>;
+    }
+    else if constexpr (op_code == InstructionSet::CALL)
+    {
+        return &CPU::CALL;
+    }
+    else if constexpr (op_code == InstructionSet::CC)
+    {
+        return &CPU::CC<condition>;
+    }
+    else if constexpr (op_code == InstructionSet::RET)
+    {
+        return &CPU::RET;
+    }
+    else if constexpr (op_code == InstructionSet::RC)
+    {
+        return &CPU::RC<condition>;
+    }
+    else if constexpr (op_code == InstructionSet::RST)
+    {
+        return &CPU::RST<interrupt>;
+    }
+    else if constexpr (op_code == InstructionSet::PCHL)
+    {
+        return &CPU::PCHL;
+    }
+    else if constexpr (op_code == InstructionSet::PUSH_PSW)
+    {
+        return &CPU::PUSH_PSW;
+    }
+    else if constexpr (op_code == InstructionSet::PUSH_rp)
+    {
+        return &CPU::PUSH_rp<register_pair>;
+    }
+    else if constexpr (op_code == InstructionSet::POP_PSW)
+    {
+        return &CPU::POP_PSW;
+    }
+    else if constexpr (op_code == InstructionSet::POP_rp)
+    {
+        return &CPU::POP_rp<register_pair>;
+    }
+    else if constexpr (op_code == InstructionSet::XTHL)
+    {
+        return &CPU::XTHL;
+    }
+    else if constexpr (op_code == InstructionSet::SPHL)
+    {
+        return &CPU::SPHL;
+    }
+    else if constexpr (op_code == InstructionSet::IN)
+    {
+        return &CPU::IN;
+    }
+    else if constexpr (op_code == InstructionSet::OUT)
+    {
+        return &CPU::OUT;
+    }
+    else if constexpr (op_code == InstructionSet::EI)
+    {
+        return &CPU::EI;
+    }
+    else if constexpr (op_code == InstructionSet::DI)
+    {
+        return &CPU::DI;
+    }
+    else if constexpr (op_code == InstructionSet::NOP)
+    {
+        return &CPU::NOP;
+    }
+    else
+    {
+        return &CPU::Unhandled;
+    }
+}
+
+template <std::size_t... op_codes>
+consteval auto CPU::CreateInstructionTable(std::index_sequence<op_codes...>) noexcept -> std::array<InstructionHandler, kInstructionCount>
+{
+    return {DecodeInstruction<static_cast<uint8_t>(op_codes)>()...};
+}
+
+constinit const std::array<CPU::InstructionHandler, CPU::kInstructionCount> CPU::kInstructionTable = CPU::CreateInstructionTable(std::make_index_sequence<CPU::kInstructionCount>{});
+
+#ifdef INTEL8080_HAS_COMPUTED_GOTO
+
+// Expands X(high, low) once for every op code 0xHL, in ascending order.
+#define INTEL8080_OP_CODE_ROW(X, high) \
+    X(high, 0)                         \
+    X(high, 1)                         \
+    X(high, 2)                         \
+    X(high, 3)                         \
+    X(high, 4)                         \
+    X(high, 5)                         \
+    X(high, 6)                         \
+    X(high, 7)                         \
+    X(high, 8)                         \
+    X(high, 9)                         \
+    X(high, A)                         \
+    X(high, B)                         \
+    X(high, C)                         \
+    X(high, D)                         \
+    X(high, E)                         \
+    X(high, F)
+
+#define INTEL8080_FOR_EACH_OP_CODE(X) \
+    INTEL8080_OP_CODE_ROW(X, 0)       \
+    INTEL8080_OP_CODE_ROW(X, 1)       \
+    INTEL8080_OP_CODE_ROW(X, 2)       \
+    INTEL8080_OP_CODE_ROW(X, 3)       \
+    INTEL8080_OP_CODE_ROW(X, 4)       \
+    INTEL8080_OP_CODE_ROW(X, 5)       \
+    INTEL8080_OP_CODE_ROW(X, 6)       \
+    INTEL8080_OP_CODE_ROW(X, 7)       \
+    INTEL8080_OP_CODE_ROW(X, 8)       \
+    INTEL8080_OP_CODE_ROW(X, 9)       \
+    INTEL8080_OP_CODE_ROW(X, A)       \
+    INTEL8080_OP_CODE_ROW(X, B)       \
+    INTEL8080_OP_CODE_ROW(X, C)       \
+    INTEL8080_OP_CODE_ROW(X, D)       \
+    INTEL8080_OP_CODE_ROW(X, E)       \
+    INTEL8080_OP_CODE_ROW(X, F)
+
+#define INTEL8080_LABEL_ADDRESS(high, low) &&op_code_##high##low,
+
+// Every handler ends in its own indirect jump to the next handler, so the branch predictor sees one dispatch site per op code.
+#define INTEL8080_DISPATCH()                   \
+    if (!executing_)                           \
+    {                                          \
+        return;                                \
+    }                                          \
+    goto *kLabels[FetchInstruction()]
+
+#define INTEL8080_THREADED_HANDLER(high, low)                 \
+    op_code_##high##low:                                     \
+    (this->*DecodeInstruction<0x##high##low>())();            \
+    INTEL8080_DISPATCH();
+
+// Labels-as-values is a GNU extension.
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wpedantic"
+
+void CPU::RunThreaded()
+{
+    static constexpr void *kLabels[kInstructionCount] = {INTEL8080_FOR_EACH_OP_CODE(INTEL8080_LABEL_ADDRESS)};
+
+    INTEL8080_DISPATCH();
+
+    INTEL8080_FOR_EACH_OP_CODE(INTEL8080_THREADED_HANDLER)
+}
+
+#pragma GCC diagnostic pop
+
+#undef INTEL8080_THREADED_HANDLER
+#undef INTEL8080_DISPATCH
+#undef INTEL8080_LABEL_ADDRESS
+#undef INTEL8080_FOR_EACH_OP_CODE
+#undef INTEL8080_OP_CODE_ROW
+
+#else
+
+void CPU::RunThreaded()
+{
+    RunTable();
+}
+
+#endif // INTEL8080_HAS_COMPUTED_GOTO
+
+void CPU::HLT()
+{
+    throw std::runtime_error("HLT");
+}
+
+template <RegisterCode destination_code>
+void CPU::MOV_r_M()
+{
+    auto &destination = GetRegister<destination_code>();
+    destination = ReadMemory(hl_);
+
+    Logger::Instance() << "MOV_r_M\n";
+}
+
+template <RegisterCode source_code>
+void CPU::MOV_M_r()
+{
+    auto &source = GetRegister<source_code>();
+    WriteMemory(hl_, source);
+
+    Logger::Instance() << "MOV_M_r\n";
+}
+
+template <RegisterCode destination_code, RegisterCode source_code>
+void CPU::MOV_r1_r2()
+{
+    auto &destination = GetRegister<destination_code>();
+    auto &source = GetRegister<source_code>();
+
+    destination = source;
+
+    Logger::Instance() << "MOV_r1_r2\n";
+}
+
+void CPU::MVI_M()
+{
+    uint8_t immediate = ReadImmediate();
+    WriteMemory(hl_, immediate);
+
+    Logger::Instance() << "MVI_M\n";
+}
+
+template <RegisterCode destination_code>
+void CPU::MVI_r()
+{
+    auto &destination = GetRegister<destination_code>();
+    destination = ReadImmediate();
+
+    Logger::Instance() << "MIV_r\n";
+}
+
+template <RegisterPairCode register_pair_code>
+void CPU::LXI()
+{
+    auto &destination = GetRegisterPair<register_pair_code>();
+    destination = ReadImmediateDWord();
+
+    Logger::Instance() << "LXI\n";
+}
+
+void CPU::LDA()
+{
+    uint16_t immediate = ReadImmediateDWord();
+    a_ = ReadMemory(immediate);
+}
+
+void CPU::LHLD()
+{
+    uint16_t immediate = ReadImmediateDWord();
+    l_ = ReadMemory(immediate);
+    h_ = ReadMemory(++immediate);
+
+    Logger::Instance() << "LHLD: " << l_ << " <- (" << immediate - 1 << ") && " << h_ << " <- (" << immediate << ")\n";
+}
+
+template <RegisterPairCode register_pair_code>
+void CPU::LDAX()
+{
+    auto &source = GetRegisterPair<register_pair_code>();
+
+    a_ = ReadMemory(source);
+
+    Logger::Instance() << "LDAX: " << a_ << " <- (" << source << ")\n";
+}
+
+void CPU::STA()
+{
+    uint16_t immediate = ReadImmediateDWord();
+    WriteMemory(immediate, a_);
+
+    Logger::Instance() << "STA: (" << int(immediate) << ")" << a_ << "\n";
+}
+
+void CPU::SHLD()
+{
+    uint16_t immediate = ReadImmediateDWord();
+    WriteMemory(immediate, l_);
+    WriteMemory(++immediate, h_);
+
+    Logger::Instance() << "SHLD: (" << immediate - 1 << ") <- " << l_ << " && (" << immediate << ")" << h_ << "\n";
+}
+
+template <RegisterPairCode register_pair_code>
+void CPU::STAX()
+{
+    auto &destination = GetRegisterPair<register_pair_code>();
+    WriteMemory(destination, a_);
+
+    Logger::Instance() << "STAX: (" << destination << ") <- " << a_ << "\n";
+}
+
+void CPU::XCHG()
+{
+    swap(h_, d_);
+    swap(l_, e_);
+
+    Logger::Instance() << "XCHG\n";
+}
+
+void CPU::ADD_M()
+{
+    uint8_t memory = ReadMemory(hl_);
+    ADD(memory);
+}
+
+template <RegisterCode source_code>
+void CPU::ADD_r()
+{
+    auto &source = GetRegister<source_code>();
+    ADD(source);
+}
+
+void CPU::ADI()
+{
+    uint8_t immediate = ReadImmediate();
+    ADD(immediate);
+}
+
+void CPU::ADC_M()
+{
+    uint8_t memory = ReadMemory(hl_);
+    ADC(memory);
+}
+
+template <RegisterCode source_code>
+void CPU::ADC_r()
+{
+    auto &source = GetRegister<source_code>();
+    ADC(source);
+}
+
+void CPU::ACI()
+{
+    uint8_t immediate = ReadImmediate();
+    ADC(immediate);
+}
+
+void CPU::SUB_M()
+{
+    uint8_t memory = ReadMemory(hl_);
+    SUB(memory);
+}
+
+template <RegisterCode source_code>
+void CPU::SUB_r()
+{
+    auto &source = GetRegister<source_code>();
+    SUB(source);
+}
+
+void CPU::SUI()
+{
+    uint8_t immediate = ReadImmediate();
+    SUB(immediate);
+}
+
+void CPU::SBB_M()
+{
+    uint8_t memory = ReadMemory(hl_);
+    SBB(memory);
+}
+
+template <RegisterCode source_code>
+void CPU::SBB_r()
+{
+    auto &source = GetRegister<source_code>();
+    SBB(source);
+}
+
+void CPU::SBI()
+{
+    uint8_t immediate = ReadImmediate();
+    SBB(immediate);
+}
+
+void CPU::INR_M()
+{
+    uint8_t memory = ReadMemory(hl_);
+    uint8_t result = INR(memory);
+    WriteMemory(hl_, result);
+
+    Logger::Instance() << "INR_M\n";
+}
+
+template <RegisterCode destination_code>
+void CPU::INR_r()
+{
+    auto &destination = GetRegister<destination_code>();
+    uint8_t result = INR(destination);
+    destination = result;
+
+    Logger::Instance() << "INR_r\n";
+}
+
+void CPU::DCR_M()
+{
+    uint8_t memory = ReadMemory(hl_);
+    uint8_t result = DCR(memory);
+    WriteMemory(hl_, result);
+
+    Logger::Instance() << "DCR_M\n";
+}
+
+template <RegisterCode destination_code>
+void CPU::DCR_r()
+{
+    auto &destination = GetRegister<destination_code>();
+    uint8_t result = DCR(destination);
+    destination = result;
+
+    Logger::Instance() << "DCR_r\n";
+}
+
+template <RegisterPairCode register_pair_code>
+void CPU::INX()
+{
+    auto &destination = GetRegisterPair<register_pair_code>();
+    ++destination;
+
+    Logger::Instance() << "INX\n";
+}
+
+template <RegisterPairCode register_pair_code>
+void CPU::DCX()
+{
+    auto &destination = GetRegisterPair<register_pair_code>();
+    --destination;
+
+    Logger::Instance() << "DCX\n";
+}
+
+template <RegisterPairCode register_pair_code>
+void CPU::DAD()
+{
+    auto &source = GetRegisterPair<register_pair_code>();
+
+    uint32_t temp = hl_ + source;
+    flags_.carry = temp > std::numeric_limits<uint16_t>::max();
+    hl_ = static_cast<uint16_t>(temp);
+
+    Logger::Instance() << "DAD\n";
+}
+
+void CPU::DAA()
+{
+    uint8_t correction = 0;
+    if (((a_ & 0b1111) > 9) || flags_.auxiliary_carry)
+    {
+        correction += 6;
+    }
+
+    if (((((a_ + correction) & 0b1111'0000) >> 4) > 9) || flags_.carry)
+    {
+        correction += (6 << 4);
+    }
+
+    ADD(correction);
+}
+
+void CPU::ANA_M()
+{
+    uint8_t memory = ReadMemory(hl_);
+    ANA(memory);
+
+    Logger::Instance() << "ANA_M\n";
+}
+
+template <RegisterCode source_code>
+void CPU::ANA_r()
+{
+    auto &source = GetRegister<source_code>();
+    ANA(source);
+
+    SetAuxiliaryCarryFlag(a_ << 1); // The 8080 logical AND instructions set the flag to reflect the logical OR of bit 3 of the values involved in the AND operation.
+
+    Logger::Instance() << "ANA_r\n";
+}
+
+void CPU::ANI()
+{
+    uint8_t immediate = ReadImmediate();
+    ANA(immediate);
+
+    flags_.auxiliary_carry = false;
+}
+
+void CPU::XRA_M()
+{
+    uint8_t memory = ReadMemory(hl_);
+    XRA(memory);
+
+    Logger::Instance() << "XRA_M\n";
+}
+
+template <RegisterCode source_code>
+void CPU::XRA_r()
+{
+    auto &source = GetRegister<source_code>();
+    XRA(source);
+
+    Logger::Instance() << "XRA_r\n";
+}
+
+void CPU::XRI()
+{
+    uint8_t immediate = ReadImmediate();
+    XRA(immediate);
+
+    Logger::Instance() << "XRI\n";
+}
+
+void CPU::ORA_M()
+{
+    uint8_t memory = ReadMemory(hl_);
+    ORA(memory);
+
+    Logger::Instance() << "ORA_M\n";
+}
+
+template <RegisterCode source_code>
+void CPU::ORA_r()
+{
+    auto &source = GetRegister<source_code>();
+    ORA(source);
+
+    Logger::Instance() << "ORA_r\n";
+}
+
+void CPU::ORI()
+{
+    uint8_t immediate = ReadImmediate();
+    ORA(immediate);
+
+    Logger::Instance() << "ORI\n";
+}
+
+void CPU::CMP_M()
+{
+    uint8_t memory = ReadMemory(hl_);
+    CMP(memory);
+
+    Logger::Instance() << "CMP_M\n";
+}
+
+template <RegisterCode source_code>
+void CPU::CMP_r()
+{
+    auto &source = GetRegister<source_code>();
+    CMP(source);
+
+    Logger::Instance() << "CMP_r\n";
+}
 
-            Logger::Instance() << "INR_M\n";
-        }
-        else // INR_R
-        {
-            auto &destination = GetDestinationRegister(op_code);
-            uint8_t result = INR(destination);
-            destination = result;
+void CPU::CPI()
+{
+    uint8_t immediate = ReadImmediate();
+    CMP(immediate);
 
-            Logger::Instance() << "INR_r\n";
-        }
-    }
-    else if (op_code == InstructionSet::DCR_r)
-    {
-        if (op_code == InstructionSet::DCR_M)
-        {
-            uint8_t memory = ReadMemory(hl_);
-            uint8_t result = DCR(memory);
-            WriteMemory(hl_, result);
+    Logger::Instance() << "CPI " << a_ << " " << +immediate << "\n";
+}
 
-            Logger::Instance() << "DCR_M\n";
-        }
-        else // DCR_R
-        {
-            auto &destination = GetDestinationRegister(op_code);
-            uint8_t result = DCR(destination);
-            destination = result;
+void CPU::RLC()
+{
+    uint16_t temp = a_ << 1;
+    SetCarryFlag(temp);
+    a_ = static_cast<uint8_t>(temp | uint8_t(flags_.carry));
 
-            Logger::Instance() << "DCR_r\n";
-        }
-    }
-    else if (op_code == InstructionSet::INX)
-    {
-        auto &destination = GetRegisterPair(op_code);
-        ++destination;
+    Logger::Instance() << "RLC\n";
+}
 
-        Logger::Instance() << "INX\n";
-    }
-    else if (op_code == InstructionSet::DCX)
-    {
-        auto &destination = GetRegisterPair(op_code);
-        --destination;
+void CPU::RRC()
+{
+    flags_.carry = a_ & 1;
+    a_ = static_cast<uint8_t>((uint8_t(flags_.carry) << 7) | (a_ >> 1));
 
-        Logger::Instance() << "DCX\n";
-    }
-    else if (op_code == InstructionSet::DAD)
-    {
-        auto &source = GetRegisterPair(op_code);
+    Logger::Instance() << "RRC\n";
+}
 
-        uint32_t temp = hl_ + source;
-        flags_.carry = temp > std::numeric_limits<uint16_t>::max();
-        hl_ = static_cast<uint16_t>(temp);
+void CPU::RAL()
+{
+    bool old_carry = flags_.carry;
+    uint16_t temp = a_ << 1;
+    SetCarryFlag(temp);
+    a_ = static_cast<uint8_t>(temp | uint8_t(old_carry));
 
-        Logger::Instance() << "DAD\n";
-    }
-    else if (op_code == InstructionSet::DAA)
-    {
-        uint8_t correction = 0;
-        if (((a_ & 0b1111) > 9) || flags_.auxiliary_carry)
-        {
-            correction += 6;
-        }
+    Logger::Instance() << "RAL\n";
+}
 
-        if (((((a_ + correction) & 0b1111'0000) >> 4) > 9) || flags_.carry)
-        {
-            correction += (6 << 4);
-        }
+void CPU::RAR()
+{
+    bool new_carry = a_ & 1;
+    a_ = static_cast<uint8_t>((uint8_t(flags_.carry) << 7 | (a_ >> 1)));
+    flags_.carry = new_carry;
 
-        ADD(correction);
-    }
-    else if (op_code == InstructionSet::ANA_r)
-    {
-        if (op_code == InstructionSet::ANA_M)
-        {
-            uint8_t memory = ReadMemory(hl_);
-            ANA(memory);
+    Logger::Instance() << "RAR\n";
+}
 
-            Logger::Instance() << "ANA_M\n";
-        }
-        else // ANA_r
-        {
-            auto &source = GetSourceRegister(op_code);
-            ANA(source);
+void CPU::CMA()
+{
+    a_ = ~a_;
 
-            SetAuxiliaryCarryFlag(a_ << 1); // The 8080 logical AND instructions set the flag to reflect the logical OR of bit 3 of the values involved in the AND operation.
+    Logger::Instance() << "CMA\n";
+}
 
-            Logger::Instance() << "ANA_r\n";
-        }
-    }
-    else if (op_code == InstructionSet::ANI)
-    {
-        uint8_t immediate = ReadImmediate();
-        ANA(immediate);
+void CPU::CMC()
+{
+    flags_.carry = !flags_.carry;
 
-        flags_.auxiliary_carry = false;
-    }
-    else if (op_code == InstructionSet::XRA_r)
-    {
-        if (op_code == InstructionSet::XRA_M)
-        {
-            uint8_t memory = ReadMemory(hl_);
-            XRA(memory);
+    Logger::Instance() << "CMC\n";
+}
 
-            Logger::Instance() << "XRA_M\n";
-        }
-        else // XRA_r
-        {
-            auto &source = GetSourceRegister(op_code);
-            XRA(source);
+void CPU::STC()
+{
+    flags_.carry = true;
 
-            Logger::Instance() << "XRA_r\n";
-        }
-    }
-    else if (op_code == InstructionSet::XRI)
-    {
-        uint8_t immediate = ReadImmediate();
-        XRA(immediate);
+    Logger::Instance() << "STC\n";
+}
 
-        Logger::Instance() << "XRI\n";
-    }
-    else if (op_code == InstructionSet::ORA_r)
-    {
-        if (op_code == InstructionSet::ORA_M)
-        {
-            uint8_t memory = ReadMemory(hl_);
-            ORA(memory);
+void CPU::JMP()
+{
+    program_counter_ = ReadImmediateDWord();
 
-            Logger::Instance() << "ORA_M\n";
-        }
-        else // ORA_r
-        {
-            auto &source = GetSourceRegister(op_code);
-            ORA(source);
+    Logger::Instance() << "JMP\n";
+}
 
-            Logger::Instance() << "ORA_r\n";
-        }
-    }
-    else if (op_code == InstructionSet::ORI)
+template <ConditionCode condition>
+void CPU::JC()
+{
+    uint16_t immediate = ReadImmediateDWord(); // has to be done unconditionally to move program_counter_ correctly
+    if (!CheckCondition<condition>())
     {
-        uint8_t immediate = ReadImmediate();
-        ORA(immediate);
-
-        Logger::Instance() << "ORI\n";
+        Logger::Instance() << "JC skipped\n";
+        return;
     }
-    else if (op_code == InstructionSet::CMP_r)
-    {
-        if (op_code == InstructionSet::CMP_M)
-        {
-            uint8_t memory = ReadMemory(hl_);
-            CMP(memory);
 
-            Logger::Instance() << "CMP_M\n";
-        }
-        else // CMP_r
-        {
-            auto &source = GetSourceRegister(op_code);
-            CMP(source);
+    program_counter_ = immediate;
 
-            Logger::Instance() << "CMP_r\n";
-        }
-    }
-    else if (op_code == InstructionSet::CPI)
-    {
-        uint8_t immediate = ReadImmediate();
-        CMP(immediate);
+    Logger::Instance() << "JC\n";
+}
 
-        Logger::Instance() << "CPI " << a_ << " " << +immediate << "\n";
-    }
-    else if (op_code == InstructionSet::RLC)
-    {
-        uint16_t temp = a_ << 1;
-        SetCarryFlag(temp);
-        a_ = static_cast<uint8_t>(temp | uint8_t(flags_.carry));
+void CPU::CALL()
+{
+    uint16_t immediate = ReadImmediateDWord();
+    Push(program_counter_);
+    program_counter_ = immediate;
 
-        Logger::Instance() << "RLC\n";
-    }
-    else if (op_code == InstructionSet::RRC)
-    {
-        flags_.carry = a_ & 1;
-        a_ = static_cast<uint8_t>((uint8_t(flags_.carry) << 7) | (a_ >> 1));
+    Logger::Instance() << "CALL\n";
+}
 
-        Logger::Instance() << "RRC\n";
-    }
-    else if (op_code == InstructionSet::RAL)
+template <ConditionCode condition>
+void CPU::CC()
+{
+    uint16_t immediate = ReadImmediateDWord(); // has to be done unconditionally to move program_counter_ correctly
+    if (!CheckCondition<condition>())
     {
-        bool old_carry = flags_.carry;
-        uint16_t temp = a_ << 1;
-        SetCarryFlag(temp);
-        a_ = static_cast<uint8_t>(temp | uint8_t(old_carry));
-
-        Logger::Instance() << "RAL\n";
+        Logger::Instance() << "CC skipped\n";
+        return;
     }
-    else if (op_code == InstructionSet::RAR)
-    {
-        bool new_carry = a_ & 1;
-        a_ = static_cast<uint8_t>((uint8_t(flags_.carry) << 7 | (a_ >> 1)));
-        flags_.carry = new_carry;
 
-        Logger::Instance() << "RAR\n";
-    }
-    else if (op_code == InstructionSet::CMA)
-    {
-        a_ = ~a_;
+    Push(program_counter_);
+    program_counter_ = immediate;
 
-        Logger::Instance() << "CMA\n";
-    }
-    else if (op_code == InstructionSet::CMC)
-    {
-        flags_.carry = !flags_.carry;
+    Logger::Instance() << "CC\n";
+}
 
-        Logger::Instance() << "CMC\n";
-    }
-    else if (op_code == InstructionSet::STC)
-    {
-        flags_.carry = true;
+void CPU::RET()
+{
+    Pop(program_counter_);
 
-        Logger::Instance() << "STC\n";
-    }
-    else if (op_code == InstructionSet::JMP || op_code == InstructionSet::JC)
+    Logger::Instance() << "RET\n";
+}
+
+template <ConditionCode condition>
+void CPU::RC()
+{
+    if (!CheckCondition<condition>())
     {
-        uint16_t immediate = ReadImmediateDWord(); // has to be done unconditionally to move program_counter_ correctly
-        if (op_code == InstructionSet::JC && !CheckCondition(op_code))
-        {
-            Logger::Instance() << "JC skipped\n";
-            return;
-        }
+        Logger::Instance() << "RET skipped\n";
+        return;
+    }
 
-        program_counter_ = immediate;
+    Pop(program_counter_);
 
-        Logger::Instance() << (op_code == InstructionSet::JMP ? "JMP" : "JC")
-                           << "\n";
-    }
-    else if (op_code == InstructionSet::CALL || op_code == InstructionSet::CC)
-    {
-        uint16_t immediate = ReadImmediateDWord(); // has to be done unconditionally to move program_counter_ correctly
-        if (op_code == InstructionSet::CC && !CheckCondition(op_code))
-        {
-            Logger::Instance() << "CC skipped\n";
-            return;
-        }
+    Logger::Instance() << "RC\n";
+}
 
-        Push(program_counter_);
-        program_counter_ = immediate;
+template <uint8_t interrupt>
+void CPU::RST()
+{
+    Push(program_counter_);
+    program_counter_ = static_cast<uint16_t>(interrupt << 3);
 
-        Logger::Instance() << (op_code == InstructionSet::CALL ? "CALL" : "CC")
-                           << "\n";
-    }
-    else if (op_code == InstructionSet::RET || op_code == InstructionSet::RC)
-    {
-        if (op_code == InstructionSet::RC && !CheckCondition(op_code))
-        {
-            Logger::Instance() << "RET skipped\n";
-            return;
-        }
+    Logger::Instance() << "RST\n";
+}
 
-        Pop(program_counter_);
+void CPU::PCHL()
+{
+    program_counter_ = hl_;
 
-        Logger::Instance() << (op_code == InstructionSet::RET ? "RET" : "RC")
-                           << "\n";
-    }
-    else if (op_code == InstructionSet::RST)
-    {
-        Push(program_counter_);
-        program_counter_ = GetInterruptAddress(op_code);
+    Logger::Instance() << "PCHL\n";
+}
 
-        Logger::Instance() << "RST\n";
-    }
-    else if (op_code == InstructionSet::PCHL)
-    {
-        program_counter_ = hl_;
+void CPU::PUSH_PSW()
+{
+    uint8_t status = static_cast<uint8_t>((uint8_t(flags_.sign) << 7) | (uint8_t(flags_.zero) << 6) | (uint8_t(flags_.auxiliary_carry) << 4) | (uint8_t(flags_.parity) << 2) | (1 << 1) | uint8_t(flags_.carry));
+    Push(a_);
+    Push(status);
 
-        Logger::Instance() << "PCHL\n";
-    }
-    else if (op_code == InstructionSet::PUSH_rp)
-    {
+    Logger::Instance() << "PUSH_PSW\n";
+}
 
-        if (op_code == InstructionSet::PUSH_PSW)
-        {
-            uint8_t status = static_cast<uint8_t>((uint8_t(flags_.sign) << 7) | (uint8_t(flags_.zero) << 6) | (uint8_t(flags_.auxiliary_carry) << 4) | (uint8_t(flags_.parity) << 2) | (1 << 1) | uint8_t(flags_.carry));
-            Push(a_);
-            Push(status);
+template <RegisterPairCode register_pair_code>
+void CPU::PUSH_rp()
+{
+    auto &source = GetRegisterPair<register_pair_code>();
+    Push(source);
 
-            Logger::Instance() << "PUSH_PSW\n";
-        }
-        else // PUSH_rp
-        {
-            auto &source = GetRegisterPair(op_code);
-            Push(source);
+    Logger::Instance() << "PUSH_rp\n";
+}
 
-            Logger::Instance() << "PUSH_rp\n";
-        }
-    }
-    else if (op_code == InstructionSet::POP_rp)
-    {
-        if (op_code == InstructionSet::POP_PSW)
-        {
-            uint8_t status;
-            Pop(status);
-            Pop(a_);
+void CPU::POP_PSW()
+{
+    uint8_t status;
+    Pop(status);
+    Pop(a_);
 
-            flags_.carry = status & 0b0000'0001;
-            flags_.parity = status & 0b0000'0100;
-            flags_.auxiliary_carry = status & 0b0001'0000;
-            flags_.zero = status & 0b0100'0000;
-            flags_.sign = status & 0b1000'0000;
+    flags_.carry = status & 0b0000'0001;
+    flags_.parity = status & 0b0000'0100;
+    flags_.auxiliary_carry = status & 0b0001'0000;
+    flags_.zero = status & 0b0100'0000;
+    flags_.sign = status & 0b1000'0000;
 
-            Logger::Instance() << "POP_PSW\n";
-        }
-        else // POP_rp
-        {
-            auto &destination = GetRegisterPair(op_code);
-            Pop(destination);
+    Logger::Instance() << "POP_PSW\n";
+}
 
-            Logger::Instance() << "POP_rp\n";
-        }
-    }
-    else if (op_code == InstructionSet::XTHL)
-    {
-        RegisterPair temp("temp");
-        temp = hl_;
-        hl_.low_ = ReadMemory(stack_pointer_);
-        WriteMemory(stack_pointer_, temp.low_);
+template <RegisterPairCode register_pair_code>
+void CPU::POP_rp()
+{
+    auto &destination = GetRegisterPair<register_pair_code>();
+    Pop(destination);
 
-        hl_.high_ = ReadMemory(stack_pointer_ + 1);
-        WriteMemory(stack_pointer_ + 1, temp.high_);
+    Logger::Instance() << "POP_rp\n";
+}
 
-        Logger::Instance() << "XTHL\n";
-    }
-    else if (op_code == InstructionSet::SPHL)
-    {
-        stack_pointer_ = hl_;
+void CPU::XTHL()
+{
+    RegisterPair temp("temp");
+    temp = hl_;
+    hl_.low_ = ReadMemory(stack_pointer_);
+    WriteMemory(stack_pointer_, temp.low_);
 
-        Logger::Instance() << "SPHL\n";
-    }
-    else if (op_code == InstructionSet::IN)
-    {
-        switch (ReadImmediate())
-        {
-        case 1:
-        {
-            a_ = 0b0000'0000;
-
-            if (sf::Keyboard::isKeyPressed(sf::Keyboard::Enter))
-            {
-                a_ = a_ | 0b0000'00001;
-            }
-
-            if (sf::Keyboard::isKeyPressed(sf::Keyboard::Num1) || sf::Keyboard::isKeyPressed(sf::Keyboard::Numpad1))
-            {
-                a_ = a_ | 0b0000'00100;
-            }
-
-            if (sf::Keyboard::isKeyPressed(sf::Keyboard::Space))
-            {
-                a_ = a_ | 0b0000'10000;
-            }
-
-            if (sf::Keyboard::isKeyPressed(sf::Keyboard::Left))
-            {
-                a_ = a_ | 0b0001'00000;
-            }
-
-            if (sf::Keyboard::isKeyPressed(sf::Keyboard::Right))
-            {
-                a_ = a_ | 0b0010'00000;
-            }
-        }
-        break;
-        case 2:
-        {
-            a_ = 0b0000'0000;
-        }
-        break;
-        case 3:
-        {
-            a_ = static_cast<uint8_t>(shift_ >> (CHAR_BIT - shift_offset_));
-        }
-        break;
-        default:
-        {
-            throw std::runtime_error("CPU::ExecuteInstruction(): IN: unsupported Port.");
-        }
-        break;
-        }
+    hl_.high_ = ReadMemory(stack_pointer_ + 1);
+    WriteMemory(stack_pointer_ + 1, temp.high_);
 
-        Logger::Instance() << "IN\n";
-    }
-    else if (op_code == InstructionSet::OUT)
+    Logger::Instance() << "XTHL\n";
+}
+
+void CPU::SPHL()
+{
+    stack_pointer_ = hl_;
+
+    Logger::Instance() << "SPHL\n";
+}
+
+void CPU::IN()
+{
+    switch (ReadImmediate())
     {
-        switch (ReadImmediate())
-        {
-        case 2:
-        {
-            shift_offset_ = a_ & 0b0000'0111;
-        }
-        break;
-        case 3:
+    case 1:
+    {
+        a_ = 0b0000'0000;
+
+        if (sf::Keyboard::isKeyPressed(sf::Keyboard::Enter))
         {
-            // sound related
+            a_ = a_ | 0b0000'00001;
         }
-        break;
-        case 4:
+
+        if (sf::Keyboard::isKeyPressed(sf::Keyboard::Num1) || sf::Keyboard::isKeyPressed(sf::Keyboard::Numpad1))
         {
-            shift_.low_ = shift_.high_;
-            shift_.high_ = a_;
+            a_ = a_ | 0b0000'00100;
         }
-        break;
-        case 5:
+
+        if (sf::Keyboard::isKeyPressed(sf::Keyboard::Space))
         {
-            // sound related
+            a_ = a_ | 0b0000'10000;
         }
-        break;
-        case 6:
+
+        if (sf::Keyboard::isKeyPressed(sf::Keyboard::Left))
         {
-            // watchdog
+            a_ = a_ | 0b0001'00000;
         }
-        break;
-        default:
+
+        if (sf::Keyboard::isKeyPressed(sf::Keyboard::Right))
         {
-            throw std::runtime_error("CPU::ExecuteInstruction(): OUT: unsupported Port.");
+            a_ = a_ | 0b0010'00000;
         }
-        break;
-        }
-
-        Logger::Instance() << "OUT\n";
     }
-    else if (op_code == InstructionSet::EI)
+    break;
+    case 2:
     {
-        std::scoped_lock lock(interrupt_mutex_);
-        interrupts_enabled_ = true;
-        interrupt_requested_ = false;
-
-        Logger::Instance() << "EI\n";
+        a_ = 0b0000'0000;
+    }
+    break;
+    case 3:
+    {
+        a_ = static_cast<uint8_t>(shift_ >> (CHAR_BIT - shift_offset_));
     }
-    else if (op_code == InstructionSet::DI)
+    break;
+    default:
     {
-        std::scoped_lock lock(interrupt_mutex_);
-        interrupts_enabled_ = false;
+        throw std::runtime_error("CPU::ExecuteInstruction(): IN: unsupported Port.");
+    }
+    break;
+    }
+
+    Logger::Instance() << "IN\n";
+}
 
-        Logger::Instance() << "DI\n";
+void CPU::OUT()
+{
+    switch (ReadImmediate())
+    {
+    case 2:
+    {
+        shift_offset_ = a_ & 0b0000'0111;
     }
-    else if (op_code == InstructionSet::NOP)
+    break;
+    case 3:
     {
-        Logger::Instance() << "NOP\n";
+        // sound related
     }
-    else
+    break;
+    case 4:
+    {
+        shift_.low_ = shift_.high_;
+        shift_.high_ = a_;
+    }
+    break;
+    case 5:
     {
-        throw std::logic_error("CPU::ExecuteInstruction(): Unhandled Instruction.");
+        // sound related
     }
+    break;
+    case 6:
+    {
+        // watchdog
+    }
+    break;
+    default:
+    {
+        throw std::runtime_error("CPU::ExecuteInstruction(): OUT: unsupported Port.");
+    }
+    break;
+    }
+
+    Logger::Instance() << "OUT\n";
+}
+
+void CPU::EI()
+{
+    std::scoped_lock lock(interrupt_mutex_);
+    interrupts_enabled_ = true;
+    interrupt_requested_ = false;
+
+    Logger::Instance() << "EI\n";
+}
+
+void CPU::DI()
+{
+    std::scoped_lock lock(interrupt_mutex_);
+    interrupts_enabled_ = false;
+
+    Logger::Instance() << "DI\n";
+}
+
+void CPU::NOP()
+{
+    Logger::Instance() << "NOP\n";
+}
+
+void CPU::Unhandled()
+{
+    throw std::logic_error("CPU::ExecuteInstruction(): Unhandled Instruction.");
 }
 
 inline void CPU::ADD(uint8_t value, bool carry) noexcept
@@ -831,139 +1312,97 @@ inline void CPU::Pop(RegisterPair &rp)
     Pop(rp.high_);
 }
 
-inline Register &CPU::GetSourceRegister(uint8_t op_code) noexcept
-{
-    return GetRegister(op_code & 0b0000'0111);
-}
-
-inline Register &CPU::GetDestinationRegister(uint8_t op_code) noexcept
-{
-    return GetRegister((op_code & 0b0011'1000) >> 3);
-}
-
-Register &CPU::GetRegister(uint8_t register_code) noexcept
+template <RegisterCode register_code>
+inline Register &CPU::GetRegister() noexcept
 {
-    assert(register_code <= 0b111 && register_code != 0b110);
+    static_assert(register_code != RegisterCode::M, "M is not a register, it addresses memory via HL");
 
-    switch (register_code)
-    {
-    case 0b111:
+    if constexpr (register_code == RegisterCode::A)
     {
         return a_;
     }
-    break;
-    case 0b000:
+    else if constexpr (register_code == RegisterCode::B)
     {
         return b_;
     }
-    case 0b001:
+    else if constexpr (register_code == RegisterCode::C)
     {
         return c_;
     }
-    case 0b010:
+    else if constexpr (register_code == RegisterCode::D)
     {
         return d_;
     }
-    case 0b011:
+    else if constexpr (register_code == RegisterCode::E)
     {
         return e_;
     }
-    case 0b100:
+    else if constexpr (register_code == RegisterCode::H)
     {
         return h_;
     }
-    case 0b101:
+    else // L
     {
         return l_;
     }
-    break;
-    default:
-    {
-        std::terminate(); // satisfy compiler (unreachable)
-    }
-    break;
-    }
 }
 
-RegisterPair &CPU::GetRegisterPair(uint8_t op_code) noexcept
+template <RegisterPairCode register_pair_code>
+inline RegisterPair &CPU::GetRegisterPair() noexcept
 {
-    switch ((op_code & 0b0011'0000) >> 4)
-    {
-    case 0b00:
+    if constexpr (register_pair_code == RegisterPairCode::BC)
     {
         return bc_;
     }
-    break;
-    case 0b01:
+    else if constexpr (register_pair_code == RegisterPairCode::DE)
     {
         return de_;
     }
-    case 0b10:
+    else if constexpr (register_pair_code == RegisterPairCode::HL)
     {
         return hl_;
     }
-    case 0b11:
+    else // SP
     {
         return stack_pointer_;
     }
-    break;
-    default:
-    {
-        std::terminate(); // satisfy compiler (unreachable)
-    }
-    break;
-    }
 }
 
-bool CPU::CheckCondition(uint8_t op_code) const noexcept
+template <ConditionCode condition>
+inline bool CPU::CheckCondition() const noexcept
 {
-    switch ((op_code & 0b0011'1000) >> 3)
-    {
-    case 0b000: // non zero
+    if constexpr (condition == ConditionCode::NotZero)
     {
         return !flags_.zero;
     }
-    break;
-    case 0b001: // zero
+    else if constexpr (condition == ConditionCode::Zero)
     {
         return flags_.zero;
     }
-    break;
-    case 0b010: // no carry
+    else if constexpr (condition == ConditionCode::NoCarry)
     {
         return !flags_.carry;
     }
-    break;
-    case 0b011: // carry
+    else if constexpr (condition == ConditionCode::Carry)
     {
         return flags_.carry;
     }
-    break;
-    case 0b100: // odd parity
+    else if constexpr (condition == ConditionCode::ParityOdd)
     {
         return !flags_.parity;
     }
-    break;
-    case 0b101: // even parity
+    else if constexpr (condition == ConditionCode::ParityEven)
     {
         return flags_.parity;
     }
-    break;
-    case 0b110: // positive
+    else if constexpr (condition == ConditionCode::Positive)
     {
         return !flags_.sign;
     }
-    case 0b111: // negative
+    else // Negative
     {
         return flags_.sign;
     }
-    break;
-    default:
-    {
-        std::terminate(); // satisfy compiler (unreachable)
-    }
-    break;
-    }
 }
 
 inline void CPU::SetAllFlags(uint16_t result, uint16_t carry_per_bit) noexcept
@@ -1018,8 +1457,3 @@ inline void CPU::SetAuxiliaryCarryFlag(uint16_t carry_per_bit) noexcept
 {
     flags_.auxiliary_carry = carry_per_bit & 0b0001'0000;
 }
-
-inline uint16_t CPU::GetInterruptAddress(uint8_t op_code) const noexcept
-{
-    return op_code & 0b0011'1000;
-}
@@ -2,16 +2,35 @@
 #define CPU_H
 
 #include <cstdint>
+#include <array>
 #include <atomic>
 #include <mutex>
+#include <utility>
 
 #include "register.h"
 #include "memory.h"
+#include "instruction.h"
+
+#if defined(__GNUC__) || defined(__clang__)
+#define INTEL8080_HAS_COMPUTED_GOTO
+#endif
 
 class CPU final
 {
 public:
-    CPU();
+    enum class ExecutionCore
+    {
+        Table,   // fetch/dispatch loop calling through kInstructionTable
+        Threaded // direct-threaded dispatch via labels-as-values, falls back to Table where unsupported
+    };
+
+#ifdef INTEL8080_THREADED_DISPATCH
+    static constexpr ExecutionCore kDefaultExecutionCore = ExecutionCore::Threaded;
+#else
+    static constexpr ExecutionCore kDefaultExecutionCore = ExecutionCore::Table;
+#endif // INTEL8080_THREADED_DISPATCH
+
+    CPU(ExecutionCore execution_core = kDefaultExecutionCore);
 
     virtual ~CPU();
 
@@ -60,6 +79,8 @@ private:
 
     Memory memory_;
 
+    const ExecutionCore execution_core_;
+
     std::atomic<bool> executing_{false};
 
     std::mutex interrupt_mutex_;
@@ -67,10 +88,198 @@ private:
     bool interrupt_requested_{false};
     uint8_t interrupt_;
 
+    void RunTable();
+
+    void RunThreaded();
+
     inline uint8_t FetchInstruction();
 
     void ExecuteInstruction(uint8_t op_code);
 
+    using InstructionHandler = void (CPU::*)();
+
+    static constexpr std::size_t kInstructionCount = 256;
+
+    static const std::array<InstructionHandler, kInstructionCount> kInstructionTable;
+
+    template <uint8_t op_code>
+    static consteval InstructionHandler DecodeInstruction() noexcept;
+
+    template <std::size_t... op_codes>
+    static consteval std::array<InstructionHandler, kInstructionCount> CreateInstructionTable(std::index_sequence<op_codes...>) noexcept;
+
+    void HLT();
+
+    template <RegisterCode destination_code>
+    void MOV_r_M();
+
+    template <RegisterCode source_code>
+    void MOV_M_r();
+
+    template <RegisterCode destination_code, RegisterCode source_code>
+    void MOV_r1_r2();
+
+    void MVI_M();
+
+    template <RegisterCode destination_code>
+    void MVI_r();
+
+    template <RegisterPairCode register_pair_code>
+    void LXI();
+
+    void LDA();
+
+    void LHLD();
+
+    template <RegisterPairCode register_pair_code>
+    void LDAX();
+
+    void STA();
+
+    void SHLD();
+
+    template <RegisterPairCode register_pair_code>
+    void STAX();
+
+    void XCHG();
+
+    void ADD_M();
+
+    template <RegisterCode source_code>
+    void ADD_r();
+
+    void ADI();
+
+    void ADC_M();
+
+    template <RegisterCode source_code>
+    void ADC_r();
+
+    void ACI();
+
+    void SUB_M();
+
+    template <RegisterCode source_code>
+    void SUB_r();
+
+    void SUI();
+
+    void SBB_M();
+
+    template <RegisterCode source_code>
+    void SBB_r();
+
+    void SBI();
+
+    void INR_M();
+
+    template <RegisterCode destination_code>
+    void INR_r();
+
+    void DCR_M();
+
+    template <RegisterCode destination_code>
+    void DCR_r();
+
+    template <RegisterPairCode register_pair_code>
+    void INX();
+
+    template <RegisterPairCode register_pair_code>
+    void DCX();
+
+    template <RegisterPairCode register_pair_code>
+    void DAD();
+
+    void DAA();
+
+    void ANA_M();
+
+    template <RegisterCode source_code>
+    void ANA_r();
+
+    void ANI();
+
+    void XRA_M();
+
+    template <RegisterCode source_code>
+    void XRA_r();
+
+    void XRI();
+
+    void ORA_M();
+
+    template <RegisterCode source_code>
+    void ORA_r();
+
+    void ORI();
+
+    void CMP_M();
+
+    template <RegisterCode source_code>
+    void CMP_r();
+
+    void CPI();
+
+    void RLC();
+
+    void RRC();
+
+    void RAL();
+
+    void RAR();
+
+    void CMA();
+
+    void CMC();
+
+    void STC();
+
+    void JMP();
+
+    template <ConditionCode condition>
+    void JC();
+
+    void CALL();
+
+    template <ConditionCode condition>
+    void CC();
+
+    void RET();
+
+    template <ConditionCode condition>
+    void RC();
+
+    template <uint8_t interrupt>
+    void RST();
+
+    void PCHL();
+
+    void PUSH_PSW();
+
+    template <RegisterPairCode register_pair_code>
+    void PUSH_rp();
+
+    void POP_PSW();
+
+    template <RegisterPairCode register_pair_code>
+    void POP_rp();
+
+    void XTHL();
+
+    void SPHL();
+
+    void IN();
+
+    void OUT();
+
+    void EI();
+
+    void DI();
+
+    void NOP();
+
+    void Unhandled();
+
     inline void ADD(uint8_t value, bool carry = false) noexcept;
 
     inline void ADC(uint8_t value) noexcept;
@@ -109,17 +318,14 @@ private:
 
     inline void Pop(RegisterPair &rp);
 
-    inline Register &GetSourceRegister(uint8_t op_code) noexcept;
-
-    inline Register &GetDestinationRegister(uint8_t op_code) noexcept;
-
-    Register &GetRegister(uint8_t register_code) noexcept;
-
-    RegisterPair &GetRegisterPair(uint8_t op_code) noexcept;
+    template <RegisterCode register_code>
+    inline Register &GetRegister() noexcept;
 
-    inline uint16_t GetInterruptAddress(uint8_t op_code) const noexcept;
+    template <RegisterPairCode register_pair_code>
+    inline RegisterPair &GetRegisterPair() noexcept;
 
-    bool CheckCondition(uint8_t op_code) const noexcept;
+    template <ConditionCode condition>
+    inline bool CheckCondition() const noexcept;
 
     inline void SetAllFlags(uint16_t result, uint16_t carry_per_bit) noexcept;
 
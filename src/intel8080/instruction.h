@@ -42,18 +42,75 @@ public:
         return !(*this == data);
     }
 
-    inline friend bool operator==(uint8_t data, const Instruction &bitmask) noexcept
+    inline friend constexpr bool operator==(uint8_t data, const Instruction &bitmask) noexcept
     {
         return bitmask == data;
     }
 
-    inline friend bool operator!=(uint8_t data, const Instruction &bitmask) noexcept
+    inline friend constexpr bool operator!=(uint8_t data, const Instruction &bitmask) noexcept
     {
         return bitmask != data;
     }
 
 };
 
+enum class RegisterCode : uint8_t
+{
+    B = 0b000,
+    C = 0b001,
+    D = 0b010,
+    E = 0b011,
+    H = 0b100,
+    L = 0b101,
+    M = 0b110,
+    A = 0b111
+};
+
+enum class RegisterPairCode : uint8_t
+{
+    BC = 0b00,
+    DE = 0b01,
+    HL = 0b10,
+    SP = 0b11
+};
+
+enum class ConditionCode : uint8_t
+{
+    NotZero = 0b000,
+    Zero = 0b001,
+    NoCarry = 0b010,
+    Carry = 0b011,
+    ParityOdd = 0b100,
+    ParityEven = 0b101,
+    Positive = 0b110,
+    Negative = 0b111
+};
+
+inline constexpr RegisterCode GetSourceRegisterCode(uint8_t op_code) noexcept // SSS
+{
+    return static_cast<RegisterCode>(op_code & 0b0000'0111);
+}
+
+inline constexpr RegisterCode GetDestinationRegisterCode(uint8_t op_code) noexcept // DDD
+{
+    return static_cast<RegisterCode>((op_code & 0b0011'1000) >> 3);
+}
+
+inline constexpr RegisterPairCode GetRegisterPairCode(uint8_t op_code) noexcept // RP
+{
+    return static_cast<RegisterPairCode>((op_code & 0b0011'0000) >> 4);
+}
+
+inline constexpr ConditionCode GetConditionCode(uint8_t op_code) noexcept // CCC
+{
+    return static_cast<ConditionCode>((op_code & 0b0011'1000) >> 3);
+}
+
+inline constexpr uint8_t GetInterruptNumber(uint8_t op_code) noexcept // NNN
+{
+    return static_cast<uint8_t>((op_code & 0b0011'1000) >> 3);
+}
+
 struct InstructionSet
 {
     static constexpr auto MOV_r1_r2 = Instruction("01DDDSSS");